@@ -9,10 +9,12 @@ INCLUDEPATH += src
 
 SOURCES += \
     src/NameGen.cpp \
-    src/RandomNameGenerator.cpp
+    src/RandomNameGenerator.cpp \
+    src/RandomNameGeneratorC.cpp
 
 HEADERS += \
-    src/RandomNameGenerator.h
+    src/RandomNameGenerator.h \
+    src/RandomNameGeneratorC.h
 
 # Default rules for deployment.
 unix {
@@ -8,6 +8,8 @@
 //		Parse an input file and produce a C++ class from it
 //		Generate names
 //
+#include <fstream>
+
 #include <showlib/CommonUsing.h>
 #include <showlib/OptionHandler.h>
 
@@ -54,4 +56,34 @@ int main(int argc, char **argv) {
     if (!gen.validate()) {
         exit(1);
     }
+
+    switch (command) {
+        case Command::Validate:
+        case Command::JSON:
+        case Command::CPP_Class:
+            break;
+
+        case Command::Generate: {
+            std::ofstream outFile;
+            if (!outputFileName.empty()) {
+                outFile.open(outputFileName);
+                if (!outFile) {
+                    cerr << "Unable to write " << outputFileName << "\n";
+                    exit(1);
+                }
+            }
+            std::ostream & out = outputFileName.empty() ? cout : outFile;
+
+            try {
+                for (int index = 0; index < count; ++index) {
+                    out << gen.compose() << "\n";
+                }
+            }
+            catch (const RNG::ConfigException &e) {
+                cerr << e.what() << "\n";
+                exit(1);
+            }
+            break;
+        }
+    }
 }
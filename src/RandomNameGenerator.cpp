@@ -1,10 +1,10 @@
 #include <algorithm>
+#include <cctype>
+#include <cstdint>
 #include <exception>
 
 #include <magic_enum/magic_enum.hpp>
 
-#include <faker/Number.h>
-
 #include <showlib/CommonUsing.h>
 #include <showlib/FileUtilities.h>
 #include <showlib/StringUtils.h>
@@ -42,6 +42,10 @@ void RNG::RandomNameGenerator::load(const string &filename) {
     middles.clear();
     suffixes.clear();
 
+    rulesForPrefixes = RuleExists();
+    rulesForMiddles = RuleExists();
+    rulesForSuffixes = RuleExists();
+
     for (const ShowLib::StringVector::Pointer & lineP: lines) {
         string line = *lineP;
         size_t pos = line.find('#');
@@ -105,7 +109,17 @@ void RNG::RandomNameGenerator::load(const string &filename) {
             }
         }
 
-        Syllable::Pointer syllableP = std::make_shared<Syllable>(*parts[0], type, prevVowel, prevConsonant, nextVowel, nextConsonant);
+        string text = *parts[0];
+        if (text[0] == '-') {
+            type = SyllableType::Prefix;
+            text = text.substr(1);
+        }
+        else if (text[0] == '+') {
+            type = SyllableType::Suffix;
+            text = text.substr(1);
+        }
+
+        Syllable::Pointer syllableP = std::make_shared<Syllable>(text, type, prevVowel, prevConsonant, nextVowel, nextConsonant);
         if (syllableP->getText().empty()) {
             continue;
         }
@@ -116,30 +130,46 @@ void RNG::RandomNameGenerator::load(const string &filename) {
             case SyllableType::Suffix: suffixes.push_back(syllableP); rulesForSuffixes.apply(*syllableP); break;
         }
     }
+
+    computeFollowing();
+}
+
+/**
+ * Work out, once, which syllables may follow each syllable.
+ */
+void RNG::RandomNameGenerator::computeFollowing() {
+    prefixChoices.clear();
+    for (const Syllable::Pointer & sylP: prefixes) {
+        prefixChoices.push_back(sylP.get());
+        sylP->computeFollowing(middles, suffixes);
+    }
+    for (const Syllable::Pointer & sylP: middles) {
+        sylP->computeFollowing(middles, suffixes);
+    }
 }
 
 /**
  * Is the data safe?
  */
-bool RNG::RandomNameGenerator::validate() {
+bool RNG::RandomNameGenerator::validate(std::ostream &out) const {
     bool retVal = true;
 
     if (prefixes.empty()) {
-        cerr << "No prefixes defined.\n";
+        out << "No prefixes defined.\n";
         retVal = false;
     }
     else {
         if ( ! middles.empty() ) {
-            retVal = retVal && rulesForPrefixes.validate(rulesForMiddles);
+            retVal = retVal && rulesForPrefixes.validate(rulesForMiddles, out);
         }
         if ( ! suffixes.empty() ) {
-            retVal = retVal && rulesForPrefixes.validate(rulesForSuffixes);
+            retVal = retVal && rulesForPrefixes.validate(rulesForSuffixes, out);
         }
     }
 
     if ( !middles.empty() ) {
         if ( ! suffixes.empty() ) {
-            retVal = retVal && rulesForMiddles.validate(rulesForSuffixes);
+            retVal = retVal && rulesForMiddles.validate(rulesForSuffixes, out);
         }
     }
 
@@ -147,16 +177,31 @@ bool RNG::RandomNameGenerator::validate() {
 }
 
 /**
- * Generate a name. If numberofSyllables == 0, we'll select a value centered on 4.
+ * Generate a name using a per-thread engine. If numberofSyllables == 0, we'll select a value centered on 4.
  */
-string RNG::RandomNameGenerator::compose(int numberOfSyllables) {
+string RNG::RandomNameGenerator::compose(int numberOfSyllables) const {
+    static thread_local Engine engine { std::random_device()() };
+
+    return compose(engine, numberOfSyllables);
+}
+
+/**
+ * Generate a name, drawing all randomness from this engine. We don't modify ourself,
+ * so this is safe to call from multiple threads as long as each has its own engine.
+ */
+string RNG::RandomNameGenerator::compose(Engine &engine, int numberOfSyllables) const {
     string retVal;
+    compose(engine, numberOfSyllables, retVal);
+    return retVal;
+}
 
+/**
+ * Generate a name and append it to output. Callers generating many names can reuse
+ * one string and avoid an allocation per name.
+ */
+void RNG::RandomNameGenerator::compose(Engine &engine, int numberOfSyllables, string &output) const {
     if (numberOfSyllables == 0) {
-        // A number [1..8] centered on 4. I'm not sure if
-        // the min and max are necessary, but in case the Faker::Number::normal()
-        // method produces value outside our range, I'm leaving those in.
-        numberOfSyllables = std::min(8, std::max(1, static_cast<int>( Faker::Number::normal( 4.0, 1.5 ) ) ) );
+        numberOfSyllables = defaultSyllableCount(engine);
     }
 
     //----------------------------------------------------------------------
@@ -175,40 +220,71 @@ string RNG::RandomNameGenerator::compose(int numberOfSyllables) {
     //----------------------------------------------------------------------
     // Grab the prefix.
     //----------------------------------------------------------------------
-    Syllable::Vector syls;
-    Syllable::Pointer prefix = pickOne(prefixes);
-    Syllable::Pointer last = prefix;
-    syls.push_back(prefix);
+    const Syllable * last = pickOne(engine, prefixChoices);
+    output += last->getText();
 
     //----------------------------------------------------------------------
     // Do the middles.
     //----------------------------------------------------------------------
     int middleCount = numberOfSyllables - 2;
     for (int index = 0; index < middleCount; ++index) {
-        last = pickOne(last->makeFollowing(middles));
-        syls.push_back(last);
+        last = pickOne(engine, last->getFollowingMiddles());
+        output += last->getText();
     }
 
     //----------------------------------------------------------------------
     // And the suffix.
     //----------------------------------------------------------------------
     if (numberOfSyllables > 1) {
-        last = pickOne(last->makeFollowing(suffixes));
-        syls.push_back(last);
+        last = pickOne(engine, last->getFollowingSuffixes());
+        output += last->getText();
     }
+}
 
-    //----------------------------------------------------------------------
-    // Assemble into a return value.
-    //----------------------------------------------------------------------
+/**
+ * A number [1..8] centered on 4, from a normal distribution with a standard deviation
+ * of 1.5. We approximate the normal distribution by summing 12 uniform values (which
+ * has a mean of 6 and a variance of 1). It can still produce values outside our range,
+ * so we clamp it.
+ */
+int RNG::RandomNameGenerator::defaultSyllableCount(Engine &engine) {
+    double sum = 0.0;
+    for (int index = 0; index < 12; ++index) {
+        sum += randomUnit(engine);
+    }
+    return std::min(8, std::max(1, static_cast<int>( 4.0 + 1.5 * (sum - 6.0) ) ) );
+}
 
-    return retVal;
+/**
+ * A number [0..bound). We throw away the few values at the bottom of the engine's range
+ * that would bias the result toward small numbers.
+ */
+size_t RNG::RandomNameGenerator::randomBelow(Engine &engine, size_t bound) {
+    uint64_t threshold = (0 - static_cast<uint64_t>(bound)) % bound;
+    uint64_t value;
+    do {
+        value = engine();
+    } while (value < threshold);
+
+    return static_cast<size_t>(value % bound);
+}
+
+/**
+ * A number [0..1), using the top 53 bits of the engine's output.
+ */
+double RNG::RandomNameGenerator::randomUnit(Engine &engine) {
+    return static_cast<double>(engine() >> 11) * (1.0 / 9007199254740992.0);
 }
 
 /**
  * Randomly pick one.
  */
-RNG::Syllable::Pointer RNG::RandomNameGenerator::pickOne(const Syllable::Vector & from) {
-    return from[ Faker::Number::between(0, from.size() - 1) ];
+const RNG::Syllable * RNG::RandomNameGenerator::pickOne(Engine &engine, const Syllable::RawVector & from) const {
+    if (from.empty()) {
+        throw RNG::ConfigException("RNG::RandomNameGenerator has no syllable that satisfies the rules");
+    }
+
+    return from[ randomBelow(engine, from.size()) ];
 }
 
 //======================================================================
@@ -302,30 +378,85 @@ JSON RNG::Syllable::toJSON() const {
     return json;
 }
 
+/**
+ * Is this a vowel? We don't count y.
+ */
+static bool isVowel(char c) {
+    switch (std::tolower(static_cast<unsigned char>(c))) {
+        case 'a': case 'e': case 'i': case 'o': case 'u':
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Is this a consonant? Anything alphabetic that isn't a vowel.
+ */
+static bool isConsonant(char c) {
+    return std::isalpha(static_cast<unsigned char>(c)) && !isVowel(c);
+}
+
+bool RNG::Syllable::endsInVowel() const {
+    return !text.empty() && isVowel(text.back());
+}
+
+bool RNG::Syllable::endsInConsonant() const {
+    return !text.empty() && isConsonant(text.back());
+}
+
+bool RNG::Syllable::beginsWithVowel() const {
+    return !text.empty() && isVowel(text.front());
+}
+
+bool RNG::Syllable::beginsWithConsonant() const {
+    return !text.empty() && isConsonant(text.front());
+}
+
+/**
+ * Can this syllable follow us?
+ */
+bool RNG::Syllable::canBeFollowedBy(const RNG::Syllable &syl) const {
+    return ! (   (endsInVowel() && syl.getPreviousMustEndInConsonant())
+              || (endsInConsonant() && syl.getPreviousMustEndInVowel())
+              || (nextMustStartWithConsonant && syl.beginsWithVowel())
+              || (nextMustStartWithVowel && syl.beginsWithConsonant()) );
+}
+
 /**
  * Return a list of syllables that can follow this one.
  */
-RNG::Syllable::Vector RNG::Syllable::makeFollowing(const RNG::Syllable::Vector &vec) {
+RNG::Syllable::Vector RNG::Syllable::makeFollowing(const RNG::Syllable::Vector &vec) const {
     Vector retVal;
-    bool vowel = endsInVowel();
-    bool consonant = endsInConsonant();
 
     for (const Pointer & possibleSylP: vec) {
-        // Eliminate based on rules.
-        if (   (vowel && possibleSylP->getPreviousMustEndInConsonant())
-            || (consonant && possibleSylP->getPreviousMustEndInVowel())
-            || (nextMustStartWithConsonant && possibleSylP->beginsWithVowel())
-            || (nextMustStartWithVowel && possibleSylP->beginsWithConsonant()) )
-        {
-            continue;
+        if (canBeFollowedBy(*possibleSylP)) {
+            retVal.push_back(possibleSylP);
         }
-
-        retVal.push_back(possibleSylP);
     }
 
     return retVal;
 }
 
+/**
+ * Remember which middles and suffixes can follow us. The pointers are only good
+ * as long as the vectors we're given hold onto their syllables.
+ */
+void RNG::Syllable::computeFollowing(const RNG::Syllable::Vector &middles, const RNG::Syllable::Vector &suffixes) {
+    followingMiddles.clear();
+    followingSuffixes.clear();
+
+    for (const Pointer & possibleSylP: middles) {
+        if (canBeFollowedBy(*possibleSylP)) {
+            followingMiddles.push_back(possibleSylP.get());
+        }
+    }
+    for (const Pointer & possibleSylP: suffixes) {
+        if (canBeFollowedBy(*possibleSylP)) {
+            followingSuffixes.push_back(possibleSylP.get());
+        }
+    }
+}
+
 
 //======================================================================
 // The Rules Engine.
@@ -372,7 +503,7 @@ void RNG::RuleExists::apply(const RNG::Syllable &syl) {
  * We only validate that we can find something to follow us. It may be there are following choices
  * that can't be used because the rules just don't work. We don't care.
  */
-bool RNG::RuleExists::validate(const RNG::RuleExists &followingRuleSet) const {
+bool RNG::RuleExists::validate(const RNG::RuleExists &followingRuleSet, std::ostream &out) const {
     bool retVal = true;
 
     if (forNext_Consonant_ReqVowel) {
@@ -380,7 +511,7 @@ bool RNG::RuleExists::validate(const RNG::RuleExists &followingRuleSet) const {
         int count = followingRuleSet.forPrev_Vowel_NoCare + followingRuleSet.forPrev_Vowel_ReqConsonant;
 
         if (count == 0) {
-            cerr << "We have prefixes ending in a consonant that require a vowel, but we may have no satisfying Middles.\n";
+            out << "We have prefixes ending in a consonant that require a vowel, but we may have no satisfying Middles.\n";
             retVal = false;
         }
     }
@@ -389,7 +520,7 @@ bool RNG::RuleExists::validate(const RNG::RuleExists &followingRuleSet) const {
         int count = followingRuleSet.forPrev_Consonant_NoCare + followingRuleSet.forPrev_Consonant_ReqConsonant;
 
         if (count == 0) {
-            cerr << "We have prefixes ending in a vowel that require a consonant, but we may have no satisfying Middles.\n";
+            out << "We have prefixes ending in a vowel that require a consonant, but we may have no satisfying Middles.\n";
             retVal = false;
         }
     }
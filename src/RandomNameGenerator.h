@@ -1,7 +1,11 @@
 #pragma once
 
 #include <exception>
+#include <iostream>
+#include <memory>
+#include <random>
 #include <string>
+#include <vector>
 
 #include <showlib/JSONSerializable.h>
 
@@ -49,6 +53,7 @@ class RNG::Syllable: public ShowLib::JSONSerializable {
 public:
     typedef std::shared_ptr<Syllable> Pointer;
     typedef ShowLib::JSONSerializableVector<Syllable> Vector;
+    typedef std::vector<const Syllable *> RawVector;
     using SyllableType = RNG::SyllableType;
 
     Syllable() = default;
@@ -70,7 +75,12 @@ public:
     bool getNextMustStartWithVowel()     const { return nextMustStartWithVowel; }
     bool getNextMustStartWithConsonant() const { return nextMustStartWithConsonant; }
 
-    Vector makeFollowing(const Vector &);
+    bool canBeFollowedBy(const Syllable &) const;
+    Vector makeFollowing(const Vector &) const;
+
+    void computeFollowing(const Vector &middles, const Vector &suffixes);
+    const RawVector & getFollowingMiddles()  const { return followingMiddles; }
+    const RawVector & getFollowingSuffixes() const { return followingSuffixes; }
 
 protected:
     // Fields
@@ -83,6 +93,12 @@ protected:
     bool previousMustEndInConsonant = false;
     bool nextMustStartWithVowel = false;
     bool nextMustStartWithConsonant = false;
+
+    // What can follow us, computed once after loading so that composing a name doesn't
+    // need to allocate or touch any shared_ptr reference counts. These point into the
+    // generator's vectors.
+    RawVector followingMiddles;
+    RawVector followingSuffixes;
 };
 
 /**
@@ -96,7 +112,7 @@ class RNG::RuleExists {
 public:
     void apply(const Syllable &);
 
-    bool validate(const RuleExists &followingRuleSet) const;
+    bool validate(const RuleExists &followingRuleSet, std::ostream &out = std::cerr) const;
 
     // For the relationship between us and the preceeding syllable.
     size_t forPrev_Consonant_NoCare = 0;
@@ -162,10 +178,16 @@ protected:
  *		rng.validate();
  *		std::string newName = rng.compose(numberOfSyllables);
  *
+ * Once loaded, the generator is read-only, so a single instance can be shared between
+ * threads. Pass your own Engine to compose() for reproducible (seeded) output; the
+ * Engine itself must not be shared between threads. We draw straight from the engine
+ * rather than through the std:: distributions, whose output differs between standard
+ * libraries, so a seed gives the same names everywhere.
+ *
  * The validate() method verifies the input file cannot generate problems. Basically, it
  * verifies that the available choices and the various rules do not lead to impossible
  * situations, such as requiring a preceding syllable ending in a consonant, but there
- * aren't any.
+ * aren't any. Problems are described on the stream you pass (cerr by default).
  */
 class RNG::RandomNameGenerator
 {
@@ -173,22 +195,37 @@ public:
     using Syllable = RNG::Syllable;
     using RuleExists = RNG::RuleExists;
     using Frequency = RNG::Frequency;
+    using Engine = std::mt19937_64;
 
     RandomNameGenerator();
     RandomNameGenerator(const std::string & filename);
 
     void load(const std::string &filename);
 
-    bool validate();
-    std::string compose(int numberOfSyllables = 0);
+    bool validate(std::ostream &out = std::cerr) const;
+    std::string compose(int numberOfSyllables = 0) const;
+    std::string compose(Engine &engine, int numberOfSyllables = 0) const;
+    void compose(Engine &engine, int numberOfSyllables, std::string &output) const;
+
+    static int defaultSyllableCount(Engine &engine);
+    static size_t randomBelow(Engine &engine, size_t bound);
+    static double randomUnit(Engine &engine);
+
+    const Syllable::Vector & getPrefixes() const { return prefixes; }
+    const Syllable::Vector & getMiddles()  const { return middles; }
+    const Syllable::Vector & getSuffixes() const { return suffixes; }
 
 protected:
-    Syllable::Pointer pickOne(const Syllable::Vector & from);
+    void computeFollowing();
+    const Syllable * pickOne(Engine &engine, const Syllable::RawVector & from) const;
 
     Syllable::Vector prefixes;
     Syllable::Vector middles;
     Syllable::Vector suffixes;
 
+    // The prefixes again, as raw pointers for pickOne().
+    Syllable::RawVector prefixChoices;
+
     RuleExists rulesForPrefixes;
     RuleExists rulesForMiddles;
     RuleExists rulesForSuffixes;
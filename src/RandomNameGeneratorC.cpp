@@ -0,0 +1,221 @@
+//
+// The C interface to RNG::RandomNameGenerator. See RandomNameGeneratorC.h.
+//
+// Nothing may throw across this boundary, so every entry point catches
+// everything and turns it into a return code plus rng_last_error().
+//
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include <showlib/CommonUsing.h>
+
+#include "RandomNameGenerator.h"
+#include "RandomNameGeneratorC.h"
+
+/**
+ * The handle we give out is just the generator.
+ */
+struct rng_generator {
+    RNG::RandomNameGenerator generator;
+};
+
+/** How many times we'll redraw a name that is too long or hits a dead end before giving up. */
+static const int MAX_LENGTH_ATTEMPTS = 100;
+
+static thread_local string lastError;
+
+/**
+ * Remember this error for rng_last_error().
+ */
+static void setError(const string &msg) {
+    lastError = msg;
+}
+
+/**
+ * So callers can verify they were built against the same header.
+ */
+int rng_abi_version(void) {
+    return RNG_ABI_VERSION;
+}
+
+/**
+ * Load a grammar. Returns NULL on failure, including a grammar with no prefixes,
+ * since nothing could ever be generated from it.
+ */
+rng_generator * rng_open(const char *filename) {
+    try {
+        if (filename == nullptr || *filename == 0) {
+            setError("rng_open: no filename given");
+            return nullptr;
+        }
+        if (!std::ifstream(filename)) {
+            setError(string("rng_open: unable to read ") + filename);
+            return nullptr;
+        }
+
+        std::unique_ptr<rng_generator> gen = std::make_unique<rng_generator>();
+        gen->generator.load(filename);
+        if (gen->generator.getPrefixes().empty()) {
+            setError(string("rng_open: no prefixes in ") + filename);
+            return nullptr;
+        }
+        return gen.release();
+    }
+    catch (const std::exception &e) {
+        setError(string("rng_open: ") + e.what());
+    }
+    catch (...) {
+        setError("rng_open: unknown error");
+    }
+    return nullptr;
+}
+
+/**
+ * Free the generator. NULL is fine.
+ */
+void rng_close(rng_generator *gen) {
+    delete gen;
+}
+
+/**
+ * Returns 1 if the grammar is safe to generate from, 0 if not, or -1 on error.
+ * When we return 0, rng_last_error() says why.
+ */
+int rng_validate(const rng_generator *gen) {
+    try {
+        if (gen == nullptr) {
+            setError("rng_validate: no generator");
+            return -1;
+        }
+        std::ostringstream reasons;
+        if (gen->generator.validate(reasons)) {
+            return 1;
+        }
+        setError("rng_validate: " + reasons.str());
+        return 0;
+    }
+    catch (const std::exception &e) {
+        setError(string("rng_validate: ") + e.what());
+    }
+    catch (...) {
+        setError("rng_validate: unknown error");
+    }
+    return -1;
+}
+
+/**
+ * Generate up to count names back-to-back into buffer. offsets must have room for count + 1
+ * entries: name i is buffer[offsets[i] .. offsets[i+1]). We stop early if the buffer fills or
+ * we can't produce a suitable name, so check the return value, which is the number of names
+ * written, or -1 on bad arguments. When we stop early, rng_last_error() says why, and the
+ * names before that point are good.
+ */
+long rng_generate_batch(
+    const rng_generator *gen,
+    const rng_options *options,
+    size_t count,
+    char *buffer,
+    size_t bufferLength,
+    size_t *offsets)
+{
+    size_t index = 0;
+
+    try {
+        if (gen == nullptr || offsets == nullptr || (buffer == nullptr && bufferLength > 0)) {
+            setError("rng_generate_batch: null argument");
+            return -1;
+        }
+
+        rng_options opts {};
+        if (options != nullptr) {
+            opts = *options;
+        }
+
+        int minSyllables = opts.min_syllables;
+        int maxSyllables = opts.max_syllables > 0 ? opts.max_syllables : minSyllables;
+        if (minSyllables < 0 || maxSyllables < minSyllables || maxSyllables > RNG_MAX_SYLLABLES) {
+            setError("rng_generate_batch: invalid syllable range");
+            return -1;
+        }
+
+        RNG::RandomNameGenerator::Engine engine { opts.seed != 0 ? opts.seed : std::random_device()() };
+
+        // The default distribution goes up to 8, but a grammar without middles can't make more
+        // than 2 syllables, and one without suffixes can't make more than 1.
+        const RNG::RandomNameGenerator & generator = gen->generator;
+        int defaultMax = generator.getSuffixes().empty() ? 1 : generator.getMiddles().empty() ? 2 : RNG_MAX_SYLLABLES;
+        if (maxSyllables > 0) {
+            defaultMax = std::min(defaultMax, maxSyllables);
+        }
+
+        size_t used = 0;
+        offsets[0] = 0;
+        string reason;
+
+        // Reused for every name so we only allocate when a name is longer than any before it.
+        string name;
+
+        for ( ; index < count; ++index) {
+            bool found = false;
+            for (int attempt = 0; attempt < MAX_LENGTH_ATTEMPTS && !found; ++attempt) {
+                int syllables = 0;
+                if (minSyllables > 0) {
+                    syllables = minSyllables + static_cast<int>(RNG::RandomNameGenerator::randomBelow(engine, maxSyllables - minSyllables + 1));
+                }
+                else {
+                    syllables = std::min(RNG::RandomNameGenerator::defaultSyllableCount(engine), defaultMax);
+                }
+
+                // The rules can lead to a dead end (validate() doesn't promise otherwise),
+                // or the caller may ask for more syllables than the grammar has. Draw again.
+                name.clear();
+                try {
+                    generator.compose(engine, syllables, name);
+                }
+                catch (const RNG::ConfigException &e) {
+                    reason = e.what();
+                    continue;
+                }
+
+                found = opts.max_length == 0 || name.length() <= opts.max_length;
+                if (!found) {
+                    reason = "unable to produce a name within max_length";
+                }
+            }
+
+            if (!found) {
+                setError("rng_generate_batch: " + reason);
+                break;
+            }
+            if (name.length() > bufferLength - used) {
+                setError("rng_generate_batch: buffer full");
+                break;
+            }
+
+            memcpy(buffer + used, name.data(), name.length());
+            used += name.length();
+            offsets[index + 1] = used;
+        }
+
+        return static_cast<long>(index);
+    }
+    catch (const std::exception &e) {
+        setError(string("rng_generate_batch: ") + e.what());
+    }
+    catch (...) {
+        setError("rng_generate_batch: unknown error");
+    }
+
+    // Whatever went wrong, the names we already wrote are good.
+    return static_cast<long>(index);
+}
+
+/**
+ * The most recent error on this thread.
+ */
+const char * rng_last_error(void) {
+    return lastError.c_str();
+}
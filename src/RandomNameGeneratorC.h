@@ -0,0 +1,105 @@
+#pragma once
+
+/**
+ * A plain C interface to RNG::RandomNameGenerator, for use from other languages
+ * (Python ctypes/cffi, Go cgo, etc.) via the shared library.
+ *
+ * To use:
+ *
+ * 		rng_generator * gen = rng_open("names.txt");
+ * 		rng_options opts = { 0 };
+ * 		opts.seed = 42;
+ *
+ * 		char buffer[65536];
+ * 		size_t offsets[1001];
+ * 		long count = rng_generate_batch(gen, &opts, 1000, buffer, sizeof(buffer), offsets);
+ *
+ * 		// Name i is buffer[offsets[i] .. offsets[i+1]). Names are not NUL-terminated.
+ *
+ * 		rng_close(gen);
+ *
+ * A generator is read-only once opened, so one handle can be shared by any number of
+ * threads calling rng_generate_batch() at the same time. Each call uses its own random
+ * engine seeded from opts.seed, so the same seed and grammar always produce the same
+ * batch, whichever platform or standard library the library was built with.
+ *
+ * On failure, functions return NULL or a negative value, and rng_last_error() describes
+ * the problem. When rng_validate() returns 0 or a batch comes back short, rng_last_error()
+ * says why.
+ * The error text is per-thread.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The library is built with hidden visibility; only what's marked RNG_API is exported.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+    #define RNG_API __attribute__((visibility("default")))
+#else
+    #define RNG_API
+#endif
+
+/** Bumped whenever the layout of rng_options or a function signature changes. */
+#define RNG_ABI_VERSION 1
+
+/** The most syllables rng_options may ask for. */
+#define RNG_MAX_SYLLABLES 16
+
+/** Opaque handle to a loaded generator. */
+typedef struct rng_generator rng_generator;
+
+/**
+ * Options for a batch. Zero-initialize to get the defaults.
+ */
+typedef struct rng_options {
+    /** Seed for the random engine. 0 means seed from the system. */
+    uint64_t seed;
+
+    /**
+     * Fewest syllables per name, up to RNG_MAX_SYLLABLES. 0 uses the default
+     * distribution: 1 to 8, centered on 4, but never more than the grammar can
+     * produce (2 without middles, 1 without suffixes).
+     */
+    int min_syllables;
+
+    /**
+     * Most syllables per name, up to RNG_MAX_SYLLABLES. 0 means the same as
+     * min_syllables. With min_syllables 0, the default distribution is capped here.
+     */
+    int max_syllables;
+
+    /**
+     * Longest acceptable name in bytes, or 0 for no limit. A name that is too long, or
+     * that the grammar's rules can't complete, is thrown away and redrawn, syllable count
+     * and all, up to 100 times. If that still fails, the batch stops there. Lowering max_syllables makes short names more likely;
+     * a max_length shorter than any prefix can never be met.
+     */
+    size_t max_length;
+} rng_options;
+
+RNG_API int rng_abi_version(void);
+
+RNG_API rng_generator * rng_open(const char *filename);
+RNG_API void rng_close(rng_generator *gen);
+
+RNG_API int rng_validate(const rng_generator *gen);
+
+RNG_API long rng_generate_batch(
+    const rng_generator *gen,
+    const rng_options *options,
+    size_t count,
+    char *buffer,
+    size_t bufferLength,
+    size_t *offsets);
+
+RNG_API const char * rng_last_error(void);
+
+#ifdef __cplusplus
+}
+#endif
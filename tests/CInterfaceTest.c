@@ -0,0 +1,220 @@
+/*
+ * Exercises the C interface in RandomNameGeneratorC.h against the shared library.
+ *
+ * 		CInterfaceTest tests/
+ *
+ * The argument is the directory holding the test grammars. Every syllable in them is
+ * two letters, so a name's syllable count is its length / 2.
+ */
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "RandomNameGeneratorC.h"
+
+#define BATCH_SIZE 1000
+#define BUFFER_SIZE (BATCH_SIZE * RNG_MAX_SYLLABLES * 2)
+#define THREAD_COUNT 4
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK failed: %s (last error: %s)\n", __FILE__, __LINE__, #cond, rng_last_error()); \
+            ++failures; \
+        } \
+    } while (0)
+
+static rng_generator * gen = NULL;
+
+/** The batch every thread should reproduce. */
+static char expected[BUFFER_SIZE];
+static size_t expectedOffsets[BATCH_SIZE + 1];
+
+/**
+ * Are all the names in this batch within [minSyllables, maxSyllables]?
+ */
+static int syllablesWithin(const size_t *offsets, long count, int minSyllables, int maxSyllables) {
+    for (long index = 0; index < count; ++index) {
+        size_t length = offsets[index + 1] - offsets[index];
+        if (length % 2 != 0 || length / 2 < (size_t)minSyllables || length / 2 > (size_t)maxSyllables) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Each thread generates the same seeded batch on the shared handle.
+ */
+static void * threadMain(void *arg) {
+    static char buffer[THREAD_COUNT][BUFFER_SIZE];
+    static size_t offsets[THREAD_COUNT][BATCH_SIZE + 1];
+    int which = *(int *)arg;
+    rng_options opts = { 0 };
+    opts.seed = 1234;
+
+    for (int pass = 0; pass < 100; ++pass) {
+        long count = rng_generate_batch(gen, &opts, BATCH_SIZE, buffer[which], BUFFER_SIZE, offsets[which]);
+        if (count != BATCH_SIZE
+            || memcmp(offsets[which], expectedOffsets, sizeof(expectedOffsets)) != 0
+            || memcmp(buffer[which], expected, expectedOffsets[BATCH_SIZE]) != 0)
+        {
+            return (void *)1;
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    char path[1024];
+    char buffer[BUFFER_SIZE];
+    size_t offsets[BATCH_SIZE + 1];
+    rng_options opts = { 0 };
+    long count;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s testDirectory\n", argv[0]);
+        return 2;
+    }
+
+    CHECK(rng_abi_version() == RNG_ABI_VERSION);
+
+    //----------------------------------------------------------------------
+    // Opening.
+    //----------------------------------------------------------------------
+    CHECK(rng_open("/no/such/grammar.txt") == NULL);
+    CHECK(strlen(rng_last_error()) > 0);
+
+    snprintf(path, sizeof(path), "%s/empty-grammar.txt", argv[1]);
+    CHECK(rng_open(path) == NULL);
+
+    snprintf(path, sizeof(path), "%s/sample-grammar.txt", argv[1]);
+    gen = rng_open(path);
+    if (gen == NULL) {
+        fprintf(stderr, "Unable to open %s: %s\n", path, rng_last_error());
+        return 1;
+    }
+    CHECK(rng_validate(gen) == 1);
+
+    //----------------------------------------------------------------------
+    // The same seed gives the same batch; a different seed doesn't.
+    //----------------------------------------------------------------------
+    opts.seed = 1234;
+    count = rng_generate_batch(gen, &opts, BATCH_SIZE, expected, sizeof(expected), expectedOffsets);
+    CHECK(count == BATCH_SIZE);
+    CHECK(expectedOffsets[0] == 0);
+    CHECK(syllablesWithin(expectedOffsets, count, 1, 8));
+
+    count = rng_generate_batch(gen, &opts, BATCH_SIZE, buffer, sizeof(buffer), offsets);
+    CHECK(count == BATCH_SIZE);
+    CHECK(memcmp(offsets, expectedOffsets, sizeof(offsets)) == 0);
+    CHECK(memcmp(buffer, expected, expectedOffsets[BATCH_SIZE]) == 0);
+
+    opts.seed = 5678;
+    count = rng_generate_batch(gen, &opts, BATCH_SIZE, buffer, sizeof(buffer), offsets);
+    CHECK(count == BATCH_SIZE);
+    CHECK(memcmp(offsets, expectedOffsets, sizeof(offsets)) != 0
+          || memcmp(buffer, expected, expectedOffsets[BATCH_SIZE]) != 0);
+
+    //----------------------------------------------------------------------
+    // Syllable bounds.
+    //----------------------------------------------------------------------
+    opts.min_syllables = 2;
+    opts.max_syllables = 3;
+    count = rng_generate_batch(gen, &opts, BATCH_SIZE, buffer, sizeof(buffer), offsets);
+    CHECK(count == BATCH_SIZE);
+    CHECK(syllablesWithin(offsets, count, 2, 3));
+
+    opts.min_syllables = 5;
+    opts.max_syllables = 0;
+    count = rng_generate_batch(gen, &opts, BATCH_SIZE, buffer, sizeof(buffer), offsets);
+    CHECK(count == BATCH_SIZE);
+    CHECK(syllablesWithin(offsets, count, 5, 5));
+
+    opts.min_syllables = 0;
+    opts.max_syllables = 2;
+    count = rng_generate_batch(gen, &opts, BATCH_SIZE, buffer, sizeof(buffer), offsets);
+    CHECK(count == BATCH_SIZE);
+    CHECK(syllablesWithin(offsets, count, 1, 2));
+
+    opts.min_syllables = 3;
+    opts.max_syllables = 2;
+    CHECK(rng_generate_batch(gen, &opts, 1, buffer, sizeof(buffer), offsets) == -1);
+
+    opts.min_syllables = 0;
+    opts.max_syllables = RNG_MAX_SYLLABLES + 1;
+    CHECK(rng_generate_batch(gen, &opts, 1, buffer, sizeof(buffer), offsets) == -1);
+
+    //----------------------------------------------------------------------
+    // A full buffer or an impossible max_length gives a partial batch.
+    //----------------------------------------------------------------------
+    opts.min_syllables = 2;
+    opts.max_syllables = 2;
+    count = rng_generate_batch(gen, &opts, 10, buffer, 9, offsets);
+    CHECK(count == 2);
+    CHECK(offsets[0] == 0 && offsets[1] == 4 && offsets[2] == 8);
+    CHECK(strstr(rng_last_error(), "buffer full") != NULL);
+
+    opts.max_length = 1;
+    count = rng_generate_batch(gen, &opts, 10, buffer, sizeof(buffer), offsets);
+    CHECK(count == 0);
+    CHECK(strstr(rng_last_error(), "max_length") != NULL);
+
+    opts.min_syllables = 0;
+    opts.max_syllables = 0;
+    opts.max_length = 4;
+    count = rng_generate_batch(gen, &opts, BATCH_SIZE, buffer, sizeof(buffer), offsets);
+    CHECK(count == BATCH_SIZE);
+    CHECK(syllablesWithin(offsets, count, 1, 2));
+
+    //----------------------------------------------------------------------
+    // A grammar with no middles only makes one- and two-syllable names, and
+    // asking for more stops the batch rather than failing it.
+    //----------------------------------------------------------------------
+    snprintf(path, sizeof(path), "%s/two-part-grammar.txt", argv[1]);
+    rng_generator * twoPart = rng_open(path);
+    CHECK(twoPart != NULL);
+    if (twoPart != NULL) {
+        rng_options defaults = { 0 };
+        defaults.seed = 1234;
+        CHECK(rng_validate(twoPart) == 1);
+
+        count = rng_generate_batch(twoPart, &defaults, BATCH_SIZE, buffer, sizeof(buffer), offsets);
+        CHECK(count == BATCH_SIZE);
+        CHECK(syllablesWithin(offsets, count, 1, 2));
+
+        defaults.min_syllables = 3;
+        count = rng_generate_batch(twoPart, &defaults, BATCH_SIZE, buffer, sizeof(buffer), offsets);
+        CHECK(count == 0);
+        CHECK(strstr(rng_last_error(), "no middles") != NULL);
+
+        rng_close(twoPart);
+    }
+
+    //----------------------------------------------------------------------
+    // Many threads on one handle.
+    //----------------------------------------------------------------------
+    pthread_t threads[THREAD_COUNT];
+    int which[THREAD_COUNT];
+    for (int index = 0; index < THREAD_COUNT; ++index) {
+        which[index] = index;
+        CHECK(pthread_create(&threads[index], NULL, threadMain, &which[index]) == 0);
+    }
+    for (int index = 0; index < THREAD_COUNT; ++index) {
+        void * result = NULL;
+        pthread_join(threads[index], &result);
+        CHECK(result == NULL);
+    }
+
+    rng_close(gen);
+    rng_close(NULL);
+
+    if (failures > 0) {
+        fprintf(stderr, "%d check(s) failed.\n", failures);
+        return 1;
+    }
+    printf("All checks passed.\n");
+    return 0;
+}